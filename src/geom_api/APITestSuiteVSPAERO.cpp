@@ -547,6 +547,81 @@ void APITestSuiteVSPAERO::TestVSPAeroSinglePoint()
     printf( "\n" );
 }
 
+void APITestSuiteVSPAERO::TestVSPAeroDegenGeomBinFile()
+{
+    printf( "APITestSuiteVSPAERO::TestVSPAeroDegenGeomBinFile()\n" );
+
+    vsp::VSPRenew();
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    //open the file created in TestVSPAeroCreateModel
+    vsp::ReadVSPFile( m_vspfname_for_vspaerotests );
+    if ( m_vspfname_for_vspaerotests == string() )
+    {
+        TEST_FAIL( "m_vspfname_for_vspaerotests = NULL, need to run: APITestSuite::TestVSPAeroComputeGeom" );
+        return;
+    }
+    if ( vsp::ErrorMgr.PopErrorAndPrint( stdout ) )
+    {
+        TEST_FAIL( "m_vspfname_for_vspaerotests failed to open" );
+        return;
+    }
+
+    // Compute geometry writes both the csv and the binary DegenGeom files
+    printf( "\t\tExecuting Comp Geom..." );
+    string geom_id = vsp::ExecAnalysis( "VSPAEROComputeGeometry" );
+    printf( "COMPLETE\n\n" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string dgb_fname = vsp::GetStringResults( geom_id, "DegenGeomBinFileName" )[0];
+    FILE* dgb_file = fopen( dgb_fname.c_str(), "rb" );
+    TEST_ASSERT( dgb_file != NULL );
+    if ( !dgb_file )
+    {
+        return;
+    }
+    fclose( dgb_file );
+
+    string analysis_name = "VSPAEROSinglePoint";
+    vector <int> num_wake_iter;
+    num_wake_iter.push_back( 1 );
+
+    // Solve from the binary file
+    printf( "\tExecuting %s from %s...", analysis_name.c_str(), dgb_fname.c_str() );
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "WakeNumIter", num_wake_iter );
+    vsp::ExecAnalysis( analysis_name );
+    printf( "COMPLETE\n" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    string history_id = vsp::FindLatestResultsID( "VSPAERO_History" );
+    double bin_CL = vsp::GetDoubleResults( history_id, "CL" )[0];
+    double bin_CDi = vsp::GetDoubleResults( history_id, "CDi" )[0];
+    double bin_CMy = vsp::GetDoubleResults( history_id, "CMy" )[0];
+
+    // Remove the binary file, and solve again from the csv file
+    remove( dgb_fname.c_str() );
+
+    printf( "\tExecuting %s from the csv file...", analysis_name.c_str() );
+    vsp::SetAnalysisInputDefaults( analysis_name );
+    vsp::SetIntAnalysisInput( analysis_name, "WakeNumIter", num_wake_iter );
+    vsp::ExecAnalysis( analysis_name );
+    printf( "COMPLETE\n" );
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+
+    history_id = vsp::FindLatestResultsID( "VSPAERO_History" );
+
+    // The binary file holds the csv values exactly, only the wake relaxation
+    // differs in the last digits from run to run
+    TEST_ASSERT_DELTA( vsp::GetDoubleResults( history_id, "CL" )[0], bin_CL, 1e-4 );
+    TEST_ASSERT_DELTA( vsp::GetDoubleResults( history_id, "CDi" )[0], bin_CDi, 1e-4 );
+    TEST_ASSERT_DELTA( vsp::GetDoubleResults( history_id, "CMy" )[0], bin_CMy, 1e-4 );
+
+    // Final check for errors
+    TEST_ASSERT( !vsp::ErrorMgr.PopErrorAndPrint( stdout ) );    //PopErrorAndPrint returns TRUE if there is an error we want ASSERT to check that this is FALSE
+    printf( "\n" );
+}
+
 void APITestSuiteVSPAERO::TestVSPAeroSinglePointStab()
 {
     printf( "APITestSuiteVSPAERO::TestVSPAeroSinglePointStab()\n" );
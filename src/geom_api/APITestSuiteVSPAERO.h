@@ -25,6 +25,7 @@ public:
         //  Vortex Lattice Method Tests
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroComputeGeom )
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSinglePoint )
+        TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroDegenGeomBinFile )
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSinglePointStab )
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSinglePointUnsteady );
         TEST_ADD( APITestSuiteVSPAERO::TestVSPAeroSweep )
@@ -52,6 +53,7 @@ private:
     void TestVSPAeroComputeGeom();        //<--Execute this VSPERO test first
     void TestVSPAeroControlSurfaceDeflection();
     void TestVSPAeroSinglePoint();
+    void TestVSPAeroDegenGeomBinFile();
     void TestVSPAeroSinglePointStab();
     void TestVSPAeroSinglePointUnsteady();
     void TestVSPAeroSweep();
@@ -3,6 +3,8 @@
 #include "WriteMatlab.h"
 #include "StringUtil.h"
 
+#include <cstdarg>
+
 #include "Vehicle.h"
 #include "VehicleMgr.h"
 
@@ -1220,6 +1222,399 @@ void DegenGeom::write_degenGeomCsv_file( FILE* file_id )
     }
 }
 
+//==== Binary DegenGeom File ====//
+// The binary file holds the same lines as the csv file.  Text lines are
+// stored as-is and rows of numbers are stored as raw doubles, so VSPAERO
+// can load the geometry without parsing text.  Each record is an int type
+// (1 = text, 2 = doubles), an int length, and the data.
+
+static const char degenBinMagic[] = "VSPDEGEN";
+static const int degenBinVersion = 1;
+static const int degenBinByteOrder = 0x01020304;
+static const int degenBinTextRecord = 1;
+static const int degenBinValuesRecord = 2;
+
+void DegenGeom::write_degenGeomBinHeader( FILE* file_id )
+{
+    fwrite( degenBinMagic, sizeof( char ), strlen( degenBinMagic ), file_id );
+    fwrite( &degenBinVersion, sizeof( int ), 1, file_id );
+    fwrite( &degenBinByteOrder, sizeof( int ), 1, file_id );
+}
+
+void DegenGeom::write_degenGeomBinText( FILE* file_id, const char* fmt, ... )
+{
+    char str[4096];
+
+    va_list args;
+    va_start( args, fmt );
+    vsnprintf( str, sizeof( str ), fmt, args );
+    va_end( args );
+
+    int len = strlen( str );
+
+    fwrite( &degenBinTextRecord, sizeof( int ), 1, file_id );
+    fwrite( &len, sizeof( int ), 1, file_id );
+    fwrite( str, sizeof( char ), len, file_id );
+}
+
+void DegenGeom::write_degenGeomBinValues( FILE* file_id, const vector< double > &vals )
+{
+    int len = vals.size();
+
+    fwrite( &degenBinValuesRecord, sizeof( int ), 1, file_id );
+    fwrite( &len, sizeof( int ), 1, file_id );
+
+    if ( len > 0 )
+    {
+        fwrite( &vals[0], sizeof( double ), len, file_id );
+    }
+}
+
+void DegenGeom::write_degenGeomSurfBin_file( FILE* file_id, int nxsecs )
+{
+    vector< double > row( 5 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type,nXsecs, nPnts/Xsec" );
+    write_degenGeomBinText( file_id, "SURFACE_NODE,%d,%d", nxsecs, num_pnts );
+    write_degenGeomBinText( file_id, "# x,y,z,u,w" );
+
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        for ( int j = 0; j < num_pnts; j++ )
+        {
+            row[0] = degenSurface.x[i][j].x();
+            row[1] = degenSurface.x[i][j].y();
+            row[2] = degenSurface.x[i][j].z();
+            row[3] = degenSurface.u[i][j];
+            row[4] = degenSurface.w[i][j];
+            write_degenGeomBinValues( file_id, row );
+        }
+    }
+
+    row.resize( 4 );
+
+    write_degenGeomBinText( file_id, "SURFACE_FACE,%d,%d", nxsecs - 1, num_pnts - 1 );
+    write_degenGeomBinText( file_id, "# nx,ny,nz,area" );
+
+    for ( int i = 0; i < nxsecs - 1; i++ )
+    {
+        for ( int j = 0; j < num_pnts - 1; j++ )
+        {
+            row[0] = degenSurface.nvec[i][j].x();
+            row[1] = degenSurface.nvec[i][j].y();
+            row[2] = degenSurface.nvec[i][j].z();
+            row[3] = degenSurface.area[i][j];
+            write_degenGeomBinValues( file_id, row );
+        }
+    }
+}
+
+void DegenGeom::write_degenGeomPlateBin_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate )
+{
+    vector< double > row( 3 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type,nXsecs,nPnts/Xsec" );
+    write_degenGeomBinText( file_id, "PLATE,%d,%d", nxsecs, ( num_pnts + 1 ) / 2 );
+    write_degenGeomBinText( file_id, "# nx,ny,nz" );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        row[0] = degenPlate.nPlate[i].x();
+        row[1] = degenPlate.nPlate[i].y();
+        row[2] = degenPlate.nPlate[i].z();
+        write_degenGeomBinValues( file_id, row );
+    }
+
+    row.resize( 11 );
+
+    write_degenGeomBinText( file_id, "# x,y,z,zCamber,t,nCamberx,nCambery,nCamberz,u,wTop,wBot" );
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        for ( int j = 0; j < ( num_pnts + 1 ) / 2; j++ )
+        {
+            row[0] = degenPlate.x[i][j].x();
+            row[1] = degenPlate.x[i][j].y();
+            row[2] = degenPlate.x[i][j].z();
+            row[3] = degenPlate.zcamber[i][j];
+            row[4] = degenPlate.t[i][j];
+            row[5] = degenPlate.nCamber[i][j].x();
+            row[6] = degenPlate.nCamber[i][j].y();
+            row[7] = degenPlate.nCamber[i][j].z();
+            row[8] = degenPlate.u[i][j];
+            row[9] = degenPlate.wTop[i][j];
+            row[10] = degenPlate.wBot[i][j];
+            write_degenGeomBinValues( file_id, row );
+        }
+    }
+}
+
+void DegenGeom::write_degenGeomStickBin_file( FILE* file_id, int nxsecs, DegenStick &degenStick )
+{
+    vector< double > row;
+    row.reserve( 66 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type, nXsecs" );
+    write_degenGeomBinText( file_id, "STICK_NODE, %d", nxsecs );
+    write_degenGeomBinText( file_id, "# lex,ley,lez,tex,tey,tez,cgShellx,cgShelly,cgShellz,"
+                            "cgSolidx,cgSolidy,cgSolidz,toc,tLoc,chord,Ishell11,Ishell22,"
+                            "Ishell12,Isolid11,Isolid22,Isolid12,sectArea,sectNormalx,"
+                            "sectNormaly,sectNormalz,perimTop,perimBot,u,"
+                            "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33,"
+                            "it00,it01,it02,it03,it10,it11,it12,it13,it20,it21,it22,it23,it30,it31,it32,it33,"
+                            "toc2,tLoc2,anglele,anglete,radleTop,radleBot," );
+
+    for ( int i = 0; i < nxsecs; i++ )
+    {
+        row.clear();
+        row.push_back( degenStick.xle[i].x() );
+        row.push_back( degenStick.xle[i].y() );
+        row.push_back( degenStick.xle[i].z() );
+        row.push_back( degenStick.xte[i].x() );
+        row.push_back( degenStick.xte[i].y() );
+        row.push_back( degenStick.xte[i].z() );
+        row.push_back( degenStick.xcgShell[i].x() );
+        row.push_back( degenStick.xcgShell[i].y() );
+        row.push_back( degenStick.xcgShell[i].z() );
+        row.push_back( degenStick.xcgSolid[i].x() );
+        row.push_back( degenStick.xcgSolid[i].y() );
+        row.push_back( degenStick.xcgSolid[i].z() );
+        row.push_back( degenStick.toc[i] );
+        row.push_back( degenStick.tLoc[i] );
+        row.push_back( degenStick.chord[i] );
+        row.push_back( degenStick.Ishell[i][0] );
+        row.push_back( degenStick.Ishell[i][1] );
+        row.push_back( degenStick.Ishell[i][2] );
+        row.push_back( degenStick.Isolid[i][0] );
+        row.push_back( degenStick.Isolid[i][1] );
+        row.push_back( degenStick.Isolid[i][2] );
+        row.push_back( degenStick.sectarea[i] );
+        row.push_back( degenStick.sectnvec[i].x() );
+        row.push_back( degenStick.sectnvec[i].y() );
+        row.push_back( degenStick.sectnvec[i].z() );
+        row.push_back( degenStick.perimTop[i] );
+        row.push_back( degenStick.perimBot[i] );
+        row.push_back( degenStick.u[i] );
+
+        for( int j = 0; j < 16; j ++ )
+        {
+            row.push_back( degenStick.transmat[i][j] );
+        }
+
+        for( int j = 0; j < 16; j ++ )
+        {
+            row.push_back( degenStick.invtransmat[i][j] );
+        }
+
+        row.push_back( degenStick.toc2[i] );
+        row.push_back( degenStick.tLoc2[i] );
+        row.push_back( degenStick.anglele[i] );
+        row.push_back( degenStick.anglete[i] );
+        row.push_back( degenStick.radleTop[i] );
+        row.push_back( degenStick.radleBot[i] );
+
+        write_degenGeomBinValues( file_id, row );
+    }
+
+    row.resize( 4 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type, nXsecs" );
+    write_degenGeomBinText( file_id, "STICK_FACE, %d", nxsecs - 1 );
+    write_degenGeomBinText( file_id, "# sweeple,sweepte,areaTop,areaBot" );
+
+    for ( int i = 0; i < nxsecs - 1; i++ )
+    {
+        row[0] = degenStick.sweeple[i];
+        row[1] = degenStick.sweepte[i];
+        row[2] = degenStick.areaTop[i];
+        row[3] = degenStick.areaBot[i];
+        write_degenGeomBinValues( file_id, row );
+    }
+}
+
+void DegenGeom::write_degenGeomPointBin_file( FILE* file_id, int nxsecs )
+{
+    vector< double > row( 22 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type" );
+    write_degenGeomBinText( file_id, "POINT" );
+    write_degenGeomBinText( file_id, "# vol,volWet,area,areaWet,Ishellxx,Ishellyy,Ishellzz,Ishellxy,"
+                            "Ishellxz,Ishellyz,Isolidxx,Isolidyy,Isolidzz,Isolidxy,Isolidxz,"
+                            "Isolidyz,cgShellx,cgShelly,cgShellz,cgSolidx,cgSolidy,cgSolidz" );
+
+    row[0] = degenPoint.vol[0];
+    row[1] = degenPoint.volWet[0];
+    row[2] = degenPoint.area[0];
+    row[3] = degenPoint.areaWet[0];
+
+    for ( int j = 0; j < 6; j++ )
+    {
+        row[4 + j] = degenPoint.Ishell[0][j];
+        row[10 + j] = degenPoint.Isolid[0][j];
+    }
+
+    row[16] = degenPoint.xcgShell[0].x();
+    row[17] = degenPoint.xcgShell[0].y();
+    row[18] = degenPoint.xcgShell[0].z();
+    row[19] = degenPoint.xcgSolid[0].x();
+    row[20] = degenPoint.xcgSolid[0].y();
+    row[21] = degenPoint.xcgSolid[0].z();
+
+    write_degenGeomBinValues( file_id, row );
+}
+
+void DegenGeom::write_degenGeomDiskBin_file( FILE* file_id )
+{
+    vector< double > row( 7 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type" );
+    write_degenGeomBinText( file_id, "PROP" );
+    write_degenGeomBinText( file_id, "# diameter,x,y,z,nx,ny,nz" );
+
+    row[0] = degenDisk.d;
+    row[1] = degenDisk.x.x();
+    row[2] = degenDisk.x.y();
+    row[3] = degenDisk.x.z();
+    row[4] = degenDisk.nvec.x();
+    row[5] = degenDisk.nvec.y();
+    row[6] = degenDisk.nvec.z();
+
+    write_degenGeomBinValues( file_id, row );
+}
+
+void DegenGeom::write_degenSubSurfBin_file( FILE* file_id, int isubsurf )
+{
+    string nospacename = degenSubSurfs[isubsurf].fullName;
+    StringUtil::chance_space_to_underscore( nospacename );
+    write_degenGeomBinText( file_id, "# DegenGeom Type, name, typeName, typeId, fullname" );
+    write_degenGeomBinText( file_id, "SUBSURF,%s,%s,%d,%s", degenSubSurfs[isubsurf].name.c_str(),
+                                                           degenSubSurfs[isubsurf].typeName.c_str(),
+                                                           degenSubSurfs[isubsurf].typeId,
+                                                           nospacename.c_str() );
+
+    write_degenGeomBinText( file_id, "# testType" );
+    write_degenGeomBinText( file_id, "%d", degenSubSurfs[isubsurf].testType );
+
+    int n = degenSubSurfs[isubsurf].u.size();
+    vector< double > row( 5 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type, nPts" );
+    write_degenGeomBinText( file_id, "SUBSURF_BNDY, %d", n );
+    write_degenGeomBinText( file_id, "# u,w,x,y,z" );
+    for ( int i = 0; i < n; i++ )
+    {
+        row[0] = degenSubSurfs[isubsurf].u[i];
+        row[1] = degenSubSurfs[isubsurf].w[i];
+        row[2] = degenSubSurfs[isubsurf].x[i].x();
+        row[3] = degenSubSurfs[isubsurf].x[i].y();
+        row[4] = degenSubSurfs[isubsurf].x[i].z();
+        write_degenGeomBinValues( file_id, row );
+    }
+}
+
+void DegenGeom::write_degenHingeLineBin_file( FILE* file_id, int ihingeline )
+{
+    int n = degenHingeLines[ihingeline].uStart.size();
+    vector< double > row( 10 );
+
+    write_degenGeomBinText( file_id, "# DegenGeom Type, name, nPts" );
+    write_degenGeomBinText( file_id, "HINGELINE,%s, %d", degenHingeLines[ihingeline].name.c_str(), n );
+
+    write_degenGeomBinText( file_id, "# uStart,uEnd,wStart,wEnd,xStart,yStart,zStart,xEnd,yEnd,zEnd" );
+    for ( int i = 0; i < n; i++ )
+    {
+        row[0] = degenHingeLines[ihingeline].uStart[i];
+        row[1] = degenHingeLines[ihingeline].uEnd[i];
+        row[2] = degenHingeLines[ihingeline].wStart[i];
+        row[3] = degenHingeLines[ihingeline].wEnd[i];
+        row[4] = degenHingeLines[ihingeline].xStart[i].x();
+        row[5] = degenHingeLines[ihingeline].xStart[i].y();
+        row[6] = degenHingeLines[ihingeline].xStart[i].z();
+        row[7] = degenHingeLines[ihingeline].xEnd[i].x();
+        row[8] = degenHingeLines[ihingeline].xEnd[i].y();
+        row[9] = degenHingeLines[ihingeline].xEnd[i].z();
+        write_degenGeomBinValues( file_id, row );
+    }
+}
+
+void DegenGeom::write_degenGeomBin_file( FILE* file_id )
+{
+    int nxsecs = num_xsecs;
+
+    string typestr;
+
+    if( type == SURFACE_TYPE )
+    {
+        typestr = "LIFTING_SURFACE";
+    }
+    else if( type == DISK_TYPE )
+    {
+        typestr = "DISK";
+    }
+    else
+    {
+        typestr = "BODY";
+    }
+
+    // The transformation matrix shares a line with the component name,
+    // so it is written as text just like the csv file
+    string matstr;
+    char str[255];
+
+    for( int j = 0; j < 16; j ++ )
+    {
+        sprintf( str, makeCsvFmt( 1, false ).c_str(), transmat[j] );
+        matstr.append( str );
+
+        if( j < 16 - 1 )
+        {
+            matstr.append( ", " );
+        }
+    }
+
+    write_degenGeomBinText( file_id, "%s", "" );
+    write_degenGeomBinText( file_id, "# DegenGeom Type, Name, SurfNdx, GeomID, MainSurfNdx, SymCopyNdx, FlipNormal,"
+                            "t00,t01,t02,t03,t10,t11,t12,t13,t20,t21,t22,t23,t30,t31,t32,t33" );
+    write_degenGeomBinText( file_id, "%s,%s,%d,%s,%d,%d,%d,%s", typestr.c_str(), name.c_str(), getSurfNum(),
+            this->parentGeom->GetID().c_str(), getMainSurfInd(), getSymCopyInd(), getFlipNormal(), matstr.c_str() );
+
+    if( type == DISK_TYPE )
+    {
+        write_degenGeomDiskBin_file( file_id );
+    }
+
+    write_degenGeomSurfBin_file( file_id, nxsecs );
+
+    if( type == DISK_TYPE )
+    {
+        return;
+    }
+
+    write_degenGeomPlateBin_file( file_id, nxsecs, degenPlates[0] );
+
+    if ( type == DegenGeom::BODY_TYPE )
+    {
+        write_degenGeomPlateBin_file( file_id, nxsecs, degenPlates[1] );
+    }
+
+    write_degenGeomStickBin_file( file_id, nxsecs, degenSticks[0] );
+
+    if ( type == DegenGeom::BODY_TYPE )
+    {
+        write_degenGeomStickBin_file( file_id, nxsecs, degenSticks[1] );
+    }
+
+    write_degenGeomPointBin_file( file_id, nxsecs );
+
+    for ( int i = 0; i < degenSubSurfs.size(); i++ )
+    {
+        write_degenSubSurfBin_file( file_id, i );
+    }
+
+    for ( int i = 0; i < degenHingeLines.size(); i++ )
+    {
+        write_degenHingeLineBin_file( file_id, i );
+    }
+}
+
 void DegenGeom::write_degenGeomSurfM_file( FILE* file_id, int nxsecs )
 {
     string basename = string( "degenGeom(end).surf." );
@@ -298,6 +298,18 @@ public:
     void write_degenSubSurfCsv_file( FILE* file_id, int isubsurf );
     void write_degenHingeLineCsv_file( FILE* file_id, int ihingeline );
 
+    static void write_degenGeomBinHeader( FILE* file_id );
+    static void write_degenGeomBinText( FILE* file_id, const char* fmt, ... );
+    static void write_degenGeomBinValues( FILE* file_id, const vector< double > &vals );
+    void write_degenGeomBin_file( FILE* file_id );
+    void write_degenGeomSurfBin_file( FILE* file_id, int nxsecs );
+    void write_degenGeomPlateBin_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate );
+    void write_degenGeomStickBin_file( FILE* file_id, int nxsecs, DegenStick &degenStick );
+    void write_degenGeomPointBin_file( FILE* file_id, int nxsecs );
+    void write_degenGeomDiskBin_file( FILE* file_id );
+    void write_degenSubSurfBin_file( FILE* file_id, int isubsurf );
+    void write_degenHingeLineBin_file( FILE* file_id, int ihingeline );
+
     void write_degenGeomM_file( FILE* file_id );
     void write_degenGeomSurfM_file( FILE* file_id, int nxsecs );
     void write_degenGeomPlateM_file( FILE* file_id, int nxsecs, DegenPlate &degenPlate, int iplate );
@@ -23,6 +23,10 @@
 
 #include <regex>
 
+#ifdef VSPAERO_LIBRARY
+#include "VSPAERO_API.H"
+#endif
+
 //==== Constructor ====//
 VspAeroControlSurf::VspAeroControlSurf()
 {
@@ -113,6 +117,9 @@ VSPAEROMgrSingleton::VSPAEROMgrSingleton() : ParmContainer()
     m_BatchModeFlag.SetDescript( "Flag to calculate in batch mode" );
     m_BatchModeFlag = true;
 
+    m_InProcessFlag.Init( "InProcessFlag", groupname, this, false, false, true );
+    m_InProcessFlag.SetDescript( "Flag to solve steady VLM cases with the linked in solver instead of the vspaero executable" );
+
     // This sets all the filename members to the appropriate value (for example: empty strings if there is no vehicle)
     UpdateFilenames();
 
@@ -270,6 +277,7 @@ void VSPAEROMgrSingleton::Renew()
     m_MachStart.Set( 0.0 ); m_MachEnd.Set( 0.0 ); m_MachNpts.Set( 1 );
 
     m_BatchModeFlag.Set( true );
+    m_InProcessFlag.Set( false );
     m_Precondition.Set( vsp::PRECON_MATRIX );
     m_KTCorrection.Set( false );
     m_Symmetry.Set( false );
@@ -480,6 +488,7 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
     // Initialize these to blanks.  if any of the checks fail the variables will at least contain an empty string
     m_ModelNameBase     = string();
     m_DegenFileFull     = string();
+    m_DegenBinFileFull  = string();
     m_CompGeomFileFull  = string();     // TODO this is set from the get export name
     m_SetupFile         = string();
     m_AdbFile           = string();
@@ -508,6 +517,7 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
                 m_ModelNameBase.erase( pos, m_ModelNameBase.length() - 1 );
             }
 
+            m_DegenBinFileFull  = m_ModelNameBase + string( ".dgb" );
             m_CompGeomFileFull  = string(); //This file is not used for vortex lattice analysis
             m_SetupFile         = m_ModelNameBase + string( ".vspaero" );
             m_AdbFile           = m_ModelNameBase + string( ".adb" );
@@ -530,6 +540,7 @@ void VSPAEROMgrSingleton::UpdateFilenames()    //A.K.A. SetupDegenFile()
             }
 
             m_DegenFileFull     = m_ModelNameBase + string( "_DegenGeom.csv" );
+            m_DegenBinFileFull  = m_ModelNameBase + string( "_DegenGeom.dgb" );
             m_SetupFile         = m_ModelNameBase + string( ".vspaero" );
             m_AdbFile           = m_ModelNameBase + string( ".adb" );
             m_HistoryFile       = m_ModelNameBase + string( ".history" );
@@ -902,6 +913,13 @@ string VSPAEROMgrSingleton::ComputeGeometry()
 
     veh->WriteDegenGeomFile();
 
+    // Binary copy of the degen geometry, vspaero reads this in place of the
+    // csv file when it is newer.  The csv file is still written as the fallback.
+    if ( !veh->WriteDegenGeomBinFile( m_DegenBinFileFull ) )
+    {
+        fprintf( stderr, "WARNING: Unable to write binary DegenGeom file: %s\n\tFile: %s \tLine:%d\n", m_DegenBinFileFull.c_str(), __FILE__, __LINE__ );
+    }
+
     // restore original values
     veh->setExportDegenGeomMFile( exptMfile_orig );
     veh->setExportDegenGeomCsvFile( exptCSVfile_orig );
@@ -951,6 +969,7 @@ string VSPAEROMgrSingleton::ComputeGeometry()
     res->Add( NameValData( "GeometrySet", m_GeomSet() ) );
     res->Add( NameValData( "AnalysisMethod", m_AnalysisMethod.Get() ) );
     res->Add( NameValData( "DegenGeomFileName", m_DegenFileFull ) );
+    res->Add( NameValData( "DegenGeomBinFileName", m_DegenBinFileFull ) );
     if ( m_AnalysisMethod.Get() == vsp::PANEL )
     {
         res->Add( NameValData( "CompGeomFileName", m_CompGeomFileFull ) );
@@ -1246,6 +1265,12 @@ string VSPAEROMgrSingleton::ComputeSolver( FILE * logFile )
     {
         ClearCpSliceResults();
     }
+#ifdef VSPAERO_LIBRARY
+    if ( m_InProcessFlag.Get() )
+    {
+        return ComputeSolverInProcess( logFile );
+    }
+#endif
     if ( m_BatchModeFlag.Get() )
     {
         return ComputeSolverBatch( logFile );
@@ -1724,6 +1749,168 @@ string VSPAEROMgrSingleton::ComputeSolverBatch( FILE * logFile )
     }
 }
 
+#ifdef VSPAERO_LIBRARY
+/* ComputeSolverInProcess(FILE * logFile)
+Solves steady VLM sweeps with the solver linked in through VSPAERO_API, and
+puts the converged coefficients straight into the results manager. Anything
+the library interface does not cover goes through the vspaero executable.
+*/
+string VSPAEROMgrSingleton::ComputeSolverInProcess( FILE * logFile )
+{
+    std::vector <string> res_id_vector;
+
+    Vehicle *veh = VehicleMgr.GetVehicle();
+
+    if ( veh )
+    {
+        vsp::VSPAERO_ANALYSIS_METHOD analysisMethod = ( vsp::VSPAERO_ANALYSIS_METHOD )m_AnalysisMethod.Get();
+
+        bool rotorsUsed = false;
+        for ( unsigned int iRotor = 0; iRotor < m_RotorDiskVec.size(); iRotor++ )
+        {
+            if ( m_RotorDiskVec[iRotor]->m_IsUsed )
+            {
+                rotorsUsed = true;
+            }
+        }
+
+        if ( analysisMethod != vsp::VORTEX_LATTICE || m_StabilityCalcFlag() || rotorsUsed ||
+             m_GroundEffectToggle() || m_Write2DFEMFlag() || m_KTCorrection() || m_FromSteadyState() ||
+             m_Precondition() != vsp::PRECON_MATRIX || m_WakeAvgStartIter() >= 1 || m_WakeSkipUntilIter() >= 1 )
+        {
+            string msg = "In process VSPAERO only solves steady VLM cases, running vspaero instead\n";
+            if ( logFile )
+            {
+                fprintf( logFile, "%s", msg.c_str() );
+            }
+            else
+            {
+                MessageData data;
+                data.m_String = "VSPAEROSolverMessage";
+                data.m_StringVec.push_back( msg );
+                MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+            }
+
+            if ( m_BatchModeFlag.Get() )
+            {
+                return ComputeSolverBatch( logFile );
+            }
+            return ComputeSolverSingle( logFile );
+        }
+
+        vector<double> alphaVec;
+        vector<double> betaVec;
+        vector<double> machVec;
+        GetSweepVectors( alphaVec, betaVec, machVec );
+
+        //====== Same settings CreateSetupFile writes for vspaero ======//
+        VSPAERO_API api;
+
+        api.Sref() = m_Sref();
+        api.Cref() = m_cref();
+        api.Bref() = m_bref();
+        api.Xcg() = m_Xcg();
+        api.Ycg() = m_Ycg();
+        api.Zcg() = m_Zcg();
+        api.Vinf() = m_Vinf();
+        api.Vref() = m_Vinf();  // vspaero uses Vinf when the setup file has no Vref
+        api.Machref() = -1.0;
+        api.Rho() = m_Rho();
+        api.ReCref() = m_ReCref();
+        api.ClMax() = m_ClMax();
+        api.MaxTurningAngle() = m_MaxTurnAngle();
+        api.FarDist() = m_FarDist();
+        api.NumberOfWakeNodes() = m_NumWakeNodes();
+        api.WakeIterations() = m_WakeNumIter.Get();
+        api.NumberOfThreads() = m_NCPU.Get();
+
+        if ( m_Symmetry() )
+        {
+            api.Symmetry() = VSPAERO_API_SYMMETRY_Y;
+        }
+
+        // Reads the binary DegenGeom written by ComputeGeometry, or the csv file
+        vector < char > modelNameBase( m_ModelNameBase.begin(), m_ModelNameBase.end() );
+        modelNameBase.push_back( '\0' );
+
+        if ( !api.ReadGeometry( &modelNameBase[0] ) )
+        {
+            fprintf( stderr, "ERROR %d: Could not load VSPAERO geometry: %s\n\tFile: %s \tLine:%d\n", vsp::VSP_FILE_READ_FAILURE, m_ModelNameBase.c_str(), __FILE__, __LINE__ );
+            return string();
+        }
+
+        //====== Loop over flight conditions in the same order as vspaero ======//
+        for ( int iBeta = 0; iBeta < betaVec.size(); iBeta++ )
+        {
+            for ( int iMach = 0; iMach < machVec.size(); iMach++ )
+            {
+                for ( int iAlpha = 0; iAlpha < alphaVec.size(); iAlpha++ )
+                {
+                    if ( !api.Solve( machVec[iMach], alphaVec[iAlpha], betaVec[iBeta] ) )
+                    {
+                        fprintf( stderr, "ERROR: VSPAERO solve failed for Mach %g, AoA %g, Beta %g\n\tFile: %s \tLine:%d\n", machVec[iMach], alphaVec[iAlpha], betaVec[iBeta], __FILE__, __LINE__ );
+                        return string();
+                    }
+
+                    // One row, the converged wake iteration of the history file
+                    Results* res = ResultsMgr.CreateResults( "VSPAERO_History" );
+                    res_id_vector.push_back( res->GetID() );
+
+                    res->Add( NameValData( "FC_Sref_", m_Sref() ) );
+                    res->Add( NameValData( "FC_Cref_", m_cref() ) );
+                    res->Add( NameValData( "FC_Bref_", m_bref() ) );
+                    res->Add( NameValData( "FC_Xcg_", m_Xcg() ) );
+                    res->Add( NameValData( "FC_Ycg_", m_Ycg() ) );
+                    res->Add( NameValData( "FC_Zcg_", m_Zcg() ) );
+                    res->Add( NameValData( "FC_Mach_", api.Mach() ) );
+                    res->Add( NameValData( "FC_AoA_", api.AoA() ) );
+                    res->Add( NameValData( "FC_Beta_", api.Beta() ) );
+                    res->Add( NameValData( "FC_Rho_", m_Rho() ) );
+                    res->Add( NameValData( "FC_Vinf_", m_Vinf() ) );
+                    AddResultHeader( res->GetID(), api.Mach(), api.AoA(), api.Beta(), analysisMethod );
+
+                    res->Add( NameValData( "WakeIter", vector < int > ( 1, m_WakeNumIter.Get() ) ) );
+                    res->Add( NameValData( "Mach", vector < double > ( 1, api.Mach() ) ) );
+                    res->Add( NameValData( "Alpha", vector < double > ( 1, api.AoA() ) ) );
+                    res->Add( NameValData( "Beta", vector < double > ( 1, api.Beta() ) ) );
+                    res->Add( NameValData( "CL", vector < double > ( 1, api.CL() ) ) );
+                    res->Add( NameValData( "CDo", vector < double > ( 1, api.CDo() ) ) );
+                    res->Add( NameValData( "CDi", vector < double > ( 1, api.CDi() ) ) );
+                    res->Add( NameValData( "CDtot", vector < double > ( 1, api.CDtot() ) ) );
+                    res->Add( NameValData( "CS", vector < double > ( 1, api.CS() ) ) );
+                    res->Add( NameValData( "L/D", vector < double > ( 1, api.LoD() ) ) );
+                    res->Add( NameValData( "E", vector < double > ( 1, api.E() ) ) );
+                    res->Add( NameValData( "CFx", vector < double > ( 1, api.CFx() ) ) );
+                    res->Add( NameValData( "CFy", vector < double > ( 1, api.CFy() ) ) );
+                    res->Add( NameValData( "CFz", vector < double > ( 1, api.CFz() ) ) );
+                    res->Add( NameValData( "CMx", vector < double > ( 1, api.CMx() ) ) );
+                    res->Add( NameValData( "CMy", vector < double > ( 1, api.CMy() ) ) );
+                    res->Add( NameValData( "CMz", vector < double > ( 1, api.CMz() ) ) );
+                    res->Add( NameValData( "T/QS", vector < double > ( 1, api.ToQS() ) ) );
+                }
+            }
+        }
+
+        // Send the message to update the screens
+        MessageData data;
+        data.m_String = "UpdateAllScreens";
+        MessageMgr::getInstance().Send( "ScreenMgr", NULL, data );
+    }
+
+    // Create "wrapper" result to contain a vector of result IDs (this maintains compatibility to return a single result after computation)
+    Results *res = ResultsMgr.CreateResults( "VSPAERO_Wrapper" );
+    if( !res )
+    {
+        return string();
+    }
+    else
+    {
+        res->Add( NameValData( "ResultsVec", res_id_vector ) );
+        return res->GetID();
+    }
+}
+#endif
+
 void VSPAEROMgrSingleton::MonitorSolver( FILE * logFile )
 {
     // ==== MonitorSolverProcess ==== //
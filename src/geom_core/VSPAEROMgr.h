@@ -201,6 +201,9 @@ public:
     string ComputeSolver( FILE * logFile = NULL ); // returns a result with a vector of results id's under the name ResultVec
     string ComputeSolverBatch( FILE * logFile = NULL );
     string ComputeSolverSingle( FILE * logFile = NULL );
+#ifdef VSPAERO_LIBRARY
+    string ComputeSolverInProcess( FILE * logFile = NULL ); // steady VLM cases through libvspaero, no vspaero process or output files
+#endif
     ProcessUtil* GetSolverProcess();
     bool IsSolverRunning();
     void KillSolver();
@@ -257,6 +260,7 @@ public:
     // File Names
     string m_ModelNameBase; // this is the name used in the execution string
     string m_DegenFileFull; //degengeom file name WITH .csv file extension
+    string m_DegenBinFileFull; //binary degengeom file name, read by vspaero in place of the csv file
     string m_CompGeomFileFull; //geometry file used for panel method
     string m_SetupFile;
     string m_AdbFile;
@@ -276,6 +280,7 @@ public:
     IntParm m_RefFlag;
 
     BoolParm m_BatchModeFlag;
+    BoolParm m_InProcessFlag;
 
     // Mass Properties Parms
     IntParm m_CGGeomSet;
@@ -4929,6 +4929,54 @@ string Vehicle::WriteDegenGeomFile()
     return outStr;
 }
 
+//==== Write Binary Degen Geom File ====//
+// Same content as the DegenGeom csv file, with the numbers stored as raw
+// doubles.  Written for VSPAERO, which reads it in place of the csv file.
+bool Vehicle::WriteDegenGeomBinFile( const string & file_name )
+{
+    FILE* file_id = fopen( file_name.c_str(), "wb" );
+
+    if ( !file_id )
+    {
+        return false;
+    }
+
+    int geomCnt = m_DegenGeomVec.size();
+    int blankCnt = m_DegenPtMassVec.size();
+
+    DegenGeom::write_degenGeomBinHeader( file_id );
+
+    DegenGeom::write_degenGeomBinText( file_id, "# DEGENERATE GEOMETRY BINARY FILE" );
+    DegenGeom::write_degenGeomBinText( file_id, "%s", "" );
+    DegenGeom::write_degenGeomBinText( file_id, "# NUMBER OF COMPONENTS" );
+    DegenGeom::write_degenGeomBinText( file_id, "%d", geomCnt );
+
+    if ( blankCnt > 0 )
+    {
+        DegenGeom::write_degenGeomBinText( file_id, "BLANK_GEOMS,%d", blankCnt );
+        DegenGeom::write_degenGeomBinText( file_id, "# Name, xLoc, yLoc, zLoc, Mass, GeomID" );
+
+        for ( int i = 0; i < blankCnt; i++ )
+        {
+            DegenGeom::write_degenGeomBinText( file_id, "%s,%f,%f,%f,%f,%s", m_DegenPtMassVec[i].name.c_str(), \
+                                                                          m_DegenPtMassVec[i].x.v[0], \
+                                                                          m_DegenPtMassVec[i].x.v[1], \
+                                                                          m_DegenPtMassVec[i].x.v[2], \
+                                                                          m_DegenPtMassVec[i].mass, \
+                                                                          m_DegenPtMassVec[i].geom_id.c_str() );
+        }
+    }
+
+    for ( int i = 0; i < geomCnt; i++ )
+    {
+        m_DegenGeomVec[i].write_degenGeomBin_file( file_id );
+    }
+
+    fclose( file_id );
+
+    return true;
+}
+
 vec3d Vehicle::CompPnt01(const std::string &geom_id, const int &surf_indx, const double &u, const double &w)
 {
     Geom* geom_ptr = FindGeom( geom_id );
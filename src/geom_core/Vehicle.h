@@ -270,6 +270,7 @@ public:
     void CreateDegenGeom( int set );
     vector< DegenGeom > GetDegenGeomVec()    { return m_DegenGeomVec; }
     string WriteDegenGeomFile();
+    bool WriteDegenGeomBinFile( const string & file_name );
     void ClearDegenGeom()   { m_DegenGeomVec.clear(); }
 
     //==== Surface Query ====//